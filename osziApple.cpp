@@ -9,8 +9,17 @@
 #include <string>
 #include <math.h>
 #include <iomanip>  // std::setprecision()
+#include <stdlib.h> // strtol(), strtod()
+#include <errno.h>
+#include <limits.h> // INT_MIN, INT_MAX
+#include <thread>
+#include <atomic>
+#include <filesystem> // std::filesystem::equivalent()
 using namespace std;
 
+/**
+ * Default settings. Most of these may be overridden on the command line or in a config file (see applySetting()).
+ */
 #define NUM_FRAMES 6562
 // FRAME_START minimum value: 1
 #define FRAME_START 1
@@ -21,7 +30,10 @@ using namespace std;
  * Setting this value to 0 maximizes image fidelity at the cost of the largest output file size.
  */
 #define PT_SPACING 0
-// to be added as a keyframe, a point must not be within EDGE units of the edge of the viewport
+/**
+ * To be added as a keyframe, a point must not be within EDGE units of the edge of the viewport.
+ * Setting this value to 0 disables edge filtering entirely.
+ */
 #define EDGE 30
 #define SVG_PATH "svgs/"
 #define SVG_WIDTH 14400
@@ -43,12 +55,27 @@ using namespace std;
  * A higher EOC_MARGIN value means a lower chance of trails appearing between disjoint curves, but an overall slower animation.
  */
 #define EOC_MARGIN 4
+/**
+ * The autotuner searches every combination of point spacing, edge and EOC margin in the grid below.
+ * The point spacing is searched from 0 to its maximum in steps of the given size.
+ * The edge is searched from the configured edge up to its maximum in steps of the given size.
+ * The EOC margin is searched from 1 to its maximum.
+ */
+#define TUNE_SPACING_STEP 10
+#define TUNE_SPACING_MAX 200
+#define TUNE_EDGE_STEP 15
+#define TUNE_EDGE_MAX 120
+#define TUNE_EOC_MARGIN_MAX 8
 // error codes
 #define ERR_NONE 0
 #define ERR_FCREATE_FAIL 1
 #define ERR_FOPEN_FAIL 2
 #define ERR_UNKNOWN_EXT 3
 #define ERR_UNKNOWN_SVG_CMD 4
+#define ERR_BAD_ARG 5
+#define ERR_CONFIG_FAIL 6
+#define ERR_TUNE_FAIL 7
+#define ERR_NO_KEYFRAMES 8
 
 // list of supported output file extensions
 enum outputFileExt {cs, anim};
@@ -60,11 +87,47 @@ typedef struct keyframeData
 	double y;
 } kframe;
 
+// an SVG path point, as parsed by processSvgFile()
+typedef struct svgPointData
+{
+	kframe pos;
+	// true if and only if this point was reached by a move command (including coordinate pairs repeated after one)
+	bool move;
+	// true if and only if a move command letter was read before this point, starting a new curve
+	bool newCurve;
+} svgPoint;
+
+/**
+ * The runtime settings. Each member defaults to its corresponding #define above.
+ */
+typedef struct configData
+{
+	int frameStart = FRAME_START;
+	int frameEnd = FRAME_END;
+	int fps = FPS;
+	double ptSpacing = PT_SPACING;
+	int edge = EDGE;
+	int eocMargin = EOC_MARGIN;
+	int decimalPlaces = DECIMAL_PLACES;
+	outputFileExt outExt = OUT_EXT;
+	string svgPath = SVG_PATH;
+	string outputName = OUTPUT_NAME;
+	// search for the best point spacing, edge and EOC margin instead of generating an output file
+	bool autotune = false;
+	// autotune targets. a target of 0 is ignored
+	int targetKeyframes = 0;
+	double targetDuration = 0;
+	int targetFrameKeyframes = 0;
+	// the names of every config file loaded, which autotune must not overwrite
+	vector<string> configFiles;
+} config;
+
 /**
  * printAnimPreamble: print necessary text found at the beginning of an ANIM file. 
+ * cfg: the runtime settings.
  * fOut: the ANIM output filestream.
  */
-void printAnimPreamble(ofstream &fOut)
+void printAnimPreamble(const config &cfg, ofstream &fOut)
 {
 	fOut << "%YAML 1.1\n"
 		"%TAG !u! tag:unity3d.com,2011:\n"
@@ -74,7 +137,7 @@ void printAnimPreamble(ofstream &fOut)
 		"  m_CorrespondingSourceObject: {fileID: 0}\n"
 		"  m_PrefabInstance: {fileID: 0}\n"
 		"  m_PrefabAsset: {fileID: 0}\n"
-		"  m_Name: " << OUTPUT_NAME << "\n"
+		"  m_Name: " << cfg.outputName << "\n"
 		"  serializedVersion: 6\n"
 		"  m_Legacy: 0\n"
 		"  m_Compressed: 0\n"
@@ -92,12 +155,13 @@ void printAnimPreamble(ofstream &fOut)
  * printAnimFrame: given a keyframe and an index, print relevant info to an ANIM file. 
  * data: the keyframe to print.
  * index: the keyframe's index in the frame vector.
+ * cfg: the runtime settings.
  * fOut: the ANIM output filestream.
  */
-void printAnimFrame(kframe &data, int index, ofstream &fOut)
+void printAnimFrame(kframe &data, int index, const config &cfg, ofstream &fOut)
 {
 	fOut <<	"      - serializedVersion: 3\n"
-		"        time: " << ((double)index / FPS) << "\n"
+		"        time: " << ((double)index / cfg.fps) << "\n"
 		"        value: {x: " << data.x << ", y: 0, z: " << data.y << "}\n"
 		"        inSlope: {x: Infinity, y: 0, z: Infinity}\n"
 		"        outSlope: {x: Infinity, y: 0, z: Infinity}\n"
@@ -110,9 +174,10 @@ void printAnimFrame(kframe &data, int index, ofstream &fOut)
 /**
  * printAnimPostamble: print necessary text found at the end of an ANIM file. 
  * kframeVec: the vector of keyframes.
+ * cfg: the runtime settings.
  * fOut: the ANIM output filestream.
  */
-void printAnimPostamble(vector<kframe> &kframeVec, ofstream &fOut)
+void printAnimPostamble(vector<kframe> &kframeVec, const config &cfg, ofstream &fOut)
 {
 	int index;
 
@@ -123,7 +188,7 @@ void printAnimPostamble(vector<kframe> &kframeVec, ofstream &fOut)
 		"  m_ScaleCurves: []\n"
 		"  m_FloatCurves: []\n"
 		"  m_PPtrCurves: []\n"
-		"  m_SampleRate: " << FPS << "\n"
+		"  m_SampleRate: " << cfg.fps << "\n"
 		"  m_WrapMode: 0\n"
 		"  m_Bounds:\n"
 		"    m_Center: {x: 0, y: 0, z: 0}\n"
@@ -143,7 +208,7 @@ void printAnimPostamble(vector<kframe> &kframeVec, ofstream &fOut)
 		"    m_AdditiveReferencePoseClip: {fileID: 0}\n"
 		"    m_AdditiveReferencePoseTime: 0\n"
 		"    m_StartTime: 0\n"
-		"    m_StopTime: " << ((double)kframeVec.size() / FPS) << "\n"
+		"    m_StopTime: " << ((double)kframeVec.size() / cfg.fps) << "\n"
 		"    m_OrientationOffsetY: 0\n"
 		"    m_Level: 0\n"
 		"    m_CycleOffset: 0\n"
@@ -167,7 +232,7 @@ void printAnimPostamble(vector<kframe> &kframeVec, ofstream &fOut)
 	for(index = 0; index < (int)kframeVec.size(); ++index)
 	{
 		fOut << "      - serializedVersion: 3\n"
-			"        time: " << ((double) index / FPS) << "\n"
+			"        time: " << ((double) index / cfg.fps) << "\n"
 			"        value: " << kframeVec.at(index).x << "\n"
 			"        inSlope: Infinity\n"
 			"        outSlope: Infinity\n"
@@ -192,7 +257,7 @@ void printAnimPostamble(vector<kframe> &kframeVec, ofstream &fOut)
 	for(index = 0; index < (int)kframeVec.size(); ++index)
 	{
 		fOut << "      - serializedVersion: 3\n"
-			"        time: " << ((double) index / FPS) << "\n"
+			"        time: " << ((double) index / cfg.fps) << "\n"
 			"        value: " << kframeVec.at(index).y << "\n"
 			"        inSlope: Infinity\n"
 			"        outSlope: Infinity\n"
@@ -219,14 +284,15 @@ void printAnimPostamble(vector<kframe> &kframeVec, ofstream &fOut)
  * printMelonFile: print the entire CSharp MelonLoader file using vector keyframe data. 
  * kframeVec: the vector of keyframes.
  * eocVec: the vector of end of curve frame numbers.
+ * cfg: the runtime settings.
  * fOut: the CS output filestream.
  */
-void printMelonFile(vector<kframe> &kframeVec, vector<int> &eocVec, ofstream &fOut)
+void printMelonFile(vector<kframe> &kframeVec, vector<int> &eocVec, const config &cfg, ofstream &fOut)
 {
 	int index;
 
 	// set the number of decimal places to be used
-	fOut << fixed << setprecision(DECIMAL_PLACES);
+	fOut << fixed << setprecision(cfg.decimalPlaces);
 
 	fOut << "using MelonLoader;\n"
 		"using UnityEngine;\n"
@@ -267,11 +333,11 @@ void printMelonFile(vector<kframe> &kframeVec, vector<int> &eocVec, ofstream &fO
 	}
 	fOut << "};\n";
 	// constants
-	fOut << "\t\t\t\tstring clipName = \"" << OUTPUT_NAME << "\";\n"
-		"\t\t\t\tint fps = " << FPS << ";\n"
+	fOut << "\t\t\t\tstring clipName = \"" << cfg.outputName << "\";\n"
+		"\t\t\t\tint fps = " << cfg.fps << ";\n"
 		"\t\t\t\tint vecLen = " << kframeVec.size() << ";\n"
 		"\t\t\t\tint eocLen = " << eocVec.size() << ";\n"
-		"\t\t\t\tint eocMargin = " << EOC_MARGIN << ";\n"
+		"\t\t\t\tint eocMargin = " << cfg.eocMargin << ";\n"
 		"\t\t\t\tfloat zIn = " << Z_IN << "f;\n"
 		"\t\t\t\tfloat zOut = " << Z_OUT << "f;\n"
 		"\t\t\t\tstring[] dims = {\"x\", \"y\"};\n";
@@ -398,8 +464,64 @@ int performCmd(char currCmd, kframe &frameOld, kframe &frameNew, ifstream &fIn,
 	return retVal;
 }
 
+/**
+ * insideEdge: check whether a point lies far enough from the edge of the viewport to be added as a keyframe.
+ * EDGED: false if and only if edge filtering is disabled, in which case every point is inside.
+ * cfg: the runtime settings.
+ * frameNew: the keyframe data of the current frame. 
+ * return true if the point is not on or near the edge.
+ */
+template<bool EDGED>
+inline bool insideEdge(const config &cfg, kframe &frameNew)
+{
+	if constexpr(EDGED)
+	{
+		return frameNew.x >= cfg.edge && frameNew.y >= cfg.edge && frameNew.x <= SVG_WIDTH - cfg.edge && frameNew.y <= SVG_HEIGHT - cfg.edge;
+	}
+	else
+	{
+		(void)cfg;
+		(void)frameNew;
+		return true;
+	}
+}
+
+/**
+ * farEnough: accumulate the distance travelled and check whether a point is far enough away from the previous keyframe.
+ * SPACED: false if and only if the point spacing is 0, in which case no distance is accumulated.
+ * cfg: the runtime settings.
+ * frameOld: the keyframe data of the previous frame. 
+ * frameNew: the keyframe data of the current frame. 
+ * distSum: a rough estimate for the current path length. Reset once the point is far enough away.
+ * return true if the point should be added.
+ */
+template<bool SPACED>
+inline bool farEnough(const config &cfg, kframe &frameOld, kframe &frameNew, double &distSum)
+{
+	bool retVal = true;
+	if constexpr(SPACED)
+	{
+		distSum += hypot(frameNew.x - frameOld.x, frameNew.y - frameOld.y);
+		retVal = distSum >= cfg.ptSpacing;
+		if(retVal)
+		{
+			distSum = 0;
+		}
+	}
+	else
+	{
+		(void)cfg;
+		(void)frameOld;
+		(void)frameNew;
+		(void)distSum;
+	}
+	return retVal;
+}
+
 /**
  * processKeyframe: given a new keyframe, process and push it to the keyframe vector.
+ * EXT, SPACED, EDGED: the output backend and spacing/edge behaviour this instantiation is specialized for.
+ * cfg: the runtime settings.
  * kframeVec: the vector of keyframes. 
  * eocVec: the vector of end of curve frame numbers.
  * frameOld: the keyframe data of the previous frame. 
@@ -408,7 +530,8 @@ int performCmd(char currCmd, kframe &frameOld, kframe &frameNew, ifstream &fIn,
  * distSum: a rough estimate for the current path length.
  * newCurve: true if and only if we have moved to a new, disjoint curve. 
  */
-void processKeyframe(vector<kframe> &kframeVec, vector<int> &eocVec, kframe &frameOld, kframe &frameNew, ofstream &fOut, double &distSum, bool &newCurve)
+template<outputFileExt EXT, bool SPACED, bool EDGED>
+void processKeyframe(const config &cfg, vector<kframe> &kframeVec, vector<int> &eocVec, kframe &frameOld, kframe &frameNew, ofstream &fOut, double &distSum, bool &newCurve)
 {
 	// frame data in terms of oscilloscope coordinates
 	kframe frameOszi;
@@ -416,24 +539,17 @@ void processKeyframe(vector<kframe> &kframeVec, vector<int> &eocVec, kframe &fra
 	int index;
 
 	// do not add a point on or near the edge
-	if(frameNew.x >= EDGE && frameNew.y >= EDGE && frameNew.x <= SVG_WIDTH - EDGE && frameNew.y <= SVG_HEIGHT - EDGE)
+	if(insideEdge<EDGED>(cfg, frameNew))
 	{
-		distSum += hypot(frameNew.x - frameOld.x, frameNew.y - frameOld.y);
 		// only add a point if it is far enough away from the previous point
-		if(distSum >= PT_SPACING)
+		if(farEnough<SPACED>(cfg, frameOld, frameNew, distSum))
 		{
-			distSum = 0;
 			// convert to oscilloscope coordinates
 			frameOszi.x = -(double)(frameNew.x - SVG_WIDTH / 2) / DIVISOR;
 			frameOszi.y = (double)(frameNew.y - SVG_HEIGHT / 2) / DIVISOR;
-			switch(OUT_EXT)
+			if constexpr(EXT == anim)
 			{
-				case anim:
-					printAnimFrame(frameOszi, kframeVec.size(), fOut);
-					break;
-				default:
-					// do nothing
-					break;
+				printAnimFrame(frameOszi, kframeVec.size(), cfg, fOut);
 			}
 			if(newCurve && kframeVec.size() > 0)
 			{
@@ -441,14 +557,14 @@ void processKeyframe(vector<kframe> &kframeVec, vector<int> &eocVec, kframe &fra
 				// the latest keyframe serves as an "end of curve" delay frame
 				temp = kframeVec.back();
 				// add some "end of curve" delay frames based on the end of curve margin size
-				for(index = 0; index < EOC_MARGIN; ++index)
+				for(index = 0; index < cfg.eocMargin; ++index)
 				{
 					kframeVec.push_back(temp);
 				}
 				// the index of the first "start of curve" delay frame is marked as end of curve
 				eocVec.push_back(kframeVec.size());
 				// add some "start of curve" delay frames based on the end of curve margin size
-				for(index = 0; index < EOC_MARGIN; ++index)
+				for(index = 0; index < cfg.eocMargin; ++index)
 				{
 					kframeVec.push_back(frameOszi);
 				}
@@ -466,14 +582,13 @@ void processKeyframe(vector<kframe> &kframeVec, vector<int> &eocVec, kframe &fra
 }
 
 /**
- * processSvgFile: Given an SVG file, process its point data and write keyframe data to the output file.
- * kframeVec: the vector of keyframe data. 
- * eocVec: the vector of end of curve frame numbers.
+ * processSvgFile: Given an SVG file, parse its point data and pass each point to processPoint.
  * fIn: the SVG input filestream. 
- * fOut: the output filestream. 
+ * processPoint: called as processPoint(currCmd, frameOld, frameNew, distSum, newCurve) for every point, see processKeyframe().
  * return 0 if and only if no errors occurred.
  */
-int processSvgFile(vector<kframe> &kframeVec, vector<int> &eocVec, ifstream &fIn, ofstream &fOut)
+template<typename PointFunc>
+int processSvgFile(ifstream &fIn, PointFunc processPoint)
 {
 	kframe frameOld;
 	kframe frameNew;
@@ -483,7 +598,7 @@ int processSvgFile(vector<kframe> &kframeVec, vector<int> &eocVec, ifstream &fIn
 	// retVal == 0 when there are no errors
 	int retVal = 0;
 	char currCmd;
-	// the distance sum of traversed curves. useful in conjuction with PT_SPACING
+	// the distance sum of traversed curves. useful in conjuction with the point spacing
 	double distSum = 0;
 
 	while(fIn >> strIn && !retVal)
@@ -513,7 +628,7 @@ int processSvgFile(vector<kframe> &kframeVec, vector<int> &eocVec, ifstream &fIn
 				retVal = performCmd(currCmd, frameOld, frameNew, fIn, endOfPath, distSum, strIn);
 				if(!retVal)
 				{
-					processKeyframe(kframeVec, eocVec, frameOld, frameNew, fOut, distSum, newCurve);
+					processPoint(currCmd, frameOld, frameNew, distSum, newCurve);
 				}
 			}
 			while(fIn >> strIn && !endOfPath && !retVal);
@@ -522,15 +637,41 @@ int processSvgFile(vector<kframe> &kframeVec, vector<int> &eocVec, ifstream &fIn
 	return retVal;
 }
 
+/**
+ * parseExtension: convert the name of an output file extension to its enum value.
+ * name: the extension name (cs, anim).
+ * ext: the enum value to store this file extension.
+ * return 0 if and only if no errors occur.
+ */
+int parseExtension(const string &name, outputFileExt &ext)
+{
+	int retVal = 0;
+	if(name == "cs")
+	{
+		ext = cs;
+	}
+	else if(name == "anim")
+	{
+		ext = anim;
+	}
+	else
+	{
+		retVal = ERR_UNKNOWN_EXT;
+		cout << "Could not recognize extension " << name << endl;
+	}
+	return retVal;
+}
+
 /**
  * getExtension: obtain the desired output file extension.
+ * cfg: the runtime settings.
  * extension: the string to store this file extension.
  * return 0 if and only if no errors occur.
  */
-int getExtension(string &extension)
+int getExtension(const config &cfg, string &extension)
 {
 	int retVal = 0;
-	switch(OUT_EXT)
+	switch(cfg.outExt)
 	{
 		case cs:
 			extension = "cs";
@@ -540,21 +681,22 @@ int getExtension(string &extension)
 			break;
 		default:
 			retVal = ERR_UNKNOWN_EXT;
-			cout << "Could not recognize extension " << OUT_EXT << endl;
+			cout << "Could not recognize extension " << cfg.outExt << endl;
 	}
 	return retVal;
 }
 
 /**
  * printPreamble: print to the output file preliminary stuff that is known before processing SVGs. 
+ * cfg: the runtime settings.
  * fOut: the output file stream.
  */
-void printPreamble(ofstream &fOut)
+void printPreamble(const config &cfg, ofstream &fOut)
 {
-	switch(OUT_EXT)
+	switch(cfg.outExt)
 	{
 		case anim:
-			printAnimPreamble(fOut);
+			printAnimPreamble(cfg, fOut);
 			break;
 		default:
 			// do nothing
@@ -566,17 +708,18 @@ void printPreamble(ofstream &fOut)
  * printPostamble: print to the output file stuff that is only available after processing SVGs. 
  * kframeVec: the vector of keyframes. 
  * eocVec: the vector of end of curve frame numbers.
+ * cfg: the runtime settings.
  * fOut: the output file stream.
  */
-void printPostamble(vector<kframe> &kframeVec, vector<int> &eocVec, ofstream &fOut)
+void printPostamble(vector<kframe> &kframeVec, vector<int> &eocVec, const config &cfg, ofstream &fOut)
 {
-	switch(OUT_EXT)
+	switch(cfg.outExt)
 	{
 		case anim:
-			printAnimPostamble(kframeVec, fOut);
+			printAnimPostamble(kframeVec, cfg, fOut);
 			break;
 		case cs:
-			printMelonFile(kframeVec, eocVec, fOut);
+			printMelonFile(kframeVec, eocVec, cfg, fOut);
 			break;
 		default:
 			// do nothing
@@ -585,13 +728,13 @@ void printPostamble(vector<kframe> &kframeVec, vector<int> &eocVec, ofstream &fO
 }
 
 /**
- * traverseSvgFiles: loop through desired SVG files in the SVG path and process each of them. 
- * kframeVec: the vector of keyframes. 
- * eocVec: the vector of end of curve frame numbers.
- * fOut: the output file stream.
+ * forEachSvgFile: loop through desired SVG files in the SVG path and process each of them. 
+ * cfg: the runtime settings.
+ * processFile: called as processFile(fIn) for every SVG file. Returns 0 if and only if no errors occur.
  * return 0 if and only if no errors occur.
  */
-int traverseSvgFiles(vector<kframe> &kframeVec, vector<int> &eocVec, ofstream &fOut)
+template<typename FileFunc>
+int forEachSvgFile(const config &cfg, FileFunc processFile)
 {
 	int retVal = 0;
 	// SVG input filestream
@@ -599,15 +742,15 @@ int traverseSvgFiles(vector<kframe> &kframeVec, vector<int> &eocVec, ofstream &f
 	int index;
 	string fileName;
 
-	for(index = FRAME_START; index <= FRAME_END && !retVal; ++index)
+	for(index = cfg.frameStart; index <= cfg.frameEnd && !retVal; ++index)
 	{
 		fileName = to_string(index);
 		// pad filename with zeros
-		fileName = SVG_PATH + string(4 - min(4, (int)fileName.length()), '0') + fileName + ".svg";
+		fileName = cfg.svgPath + string(4 - min(4, (int)fileName.length()), '0') + fileName + ".svg";
 		fIn.open(fileName, ios::in);
 		if(fIn)
 		{
-			retVal = processSvgFile(kframeVec, eocVec, fIn, fOut);
+			retVal = processFile(fIn);
 			fIn.close();
 			if(retVal)
 			{
@@ -623,6 +766,754 @@ int traverseSvgFiles(vector<kframe> &kframeVec, vector<int> &eocVec, ofstream &f
 	return retVal;
 }
 
+/**
+ * traverseSvgFiles: process the desired SVG files and write keyframe data to the output file.
+ * EXT, SPACED, EDGED: see processKeyframe().
+ * cfg: the runtime settings.
+ * kframeVec: the vector of keyframes. 
+ * eocVec: the vector of end of curve frame numbers.
+ * fOut: the output file stream.
+ * return 0 if and only if no errors occur.
+ */
+template<outputFileExt EXT, bool SPACED, bool EDGED>
+int traverseSvgFiles(const config &cfg, vector<kframe> &kframeVec, vector<int> &eocVec, ofstream &fOut)
+{
+	return forEachSvgFile(cfg, [&](ifstream &fIn)
+	{
+		return processSvgFile(fIn, [&](char currCmd, kframe &frameOld, kframe &frameNew, double &distSum, bool &newCurve)
+		{
+			(void)currCmd;
+			processKeyframe<EXT, SPACED, EDGED>(cfg, kframeVec, eocVec, frameOld, frameNew, fOut, distSum, newCurve);
+		});
+	});
+}
+
+// a traverseSvgFiles() instantiation
+typedef int (*traverseFunc)(const config &, vector<kframe> &, vector<int> &, ofstream &);
+
+/**
+ * selectEdge: select the traverseSvgFiles() instantiation matching the edge filtering setting.
+ * cfg: the runtime settings.
+ * return the selected instantiation.
+ */
+template<outputFileExt EXT, bool SPACED>
+traverseFunc selectEdge(const config &cfg)
+{
+	return cfg.edge > 0 ? traverseSvgFiles<EXT, SPACED, true> : traverseSvgFiles<EXT, SPACED, false>;
+}
+
+/**
+ * selectSpacing: select the traverseSvgFiles() instantiation matching the point spacing and edge filtering settings.
+ * cfg: the runtime settings.
+ * return the selected instantiation.
+ */
+template<outputFileExt EXT>
+traverseFunc selectSpacing(const config &cfg)
+{
+	return cfg.ptSpacing > 0 ? selectEdge<EXT, true>(cfg) : selectEdge<EXT, false>(cfg);
+}
+
+/**
+ * selectTraverse: select the traverseSvgFiles() instantiation matching the runtime settings.
+ * This is done once at startup so that the per-point loop does not branch on any setting.
+ * cfg: the runtime settings.
+ * return the selected instantiation.
+ */
+traverseFunc selectTraverse(const config &cfg)
+{
+	traverseFunc retVal;
+	switch(cfg.outExt)
+	{
+		case anim:
+			retVal = selectSpacing<anim>(cfg);
+			break;
+		default:
+			retVal = selectSpacing<cs>(cfg);
+			break;
+	}
+	return retVal;
+}
+
+/**
+ * loadSvgFiles: parse the desired SVG files into memory, so that keyframe selection may be repeated without reparsing.
+ * cfg: the runtime settings.
+ * frames: the vector to store the points of each SVG file.
+ * pathLength: the total length of every curve within the configured edge, in SVG units.
+ * return 0 if and only if no errors occur.
+ */
+int loadSvgFiles(const config &cfg, vector<vector<svgPoint>> &frames, double &pathLength)
+{
+	return forEachSvgFile(cfg, [&](ifstream &fIn)
+	{
+		// the previous point. frameOld cannot be used, as performCmd() overwrites it on every move command
+		kframe last = {0, 0};
+		frames.emplace_back();
+		vector<svgPoint> &points = frames.back();
+		return processSvgFile(fIn, [&](char currCmd, kframe &frameOld, kframe &frameNew, double &distSum, bool &newCurve)
+		{
+			(void)distSum;
+			// coordinate pairs repeated after a move command are still joined to the previous point.
+			// segments the configured edge filters out are not counted against any trial
+			if(!newCurve && (cfg.edge == 0 || (insideEdge<true>(cfg, last) && insideEdge<true>(cfg, frameNew))))
+			{
+				pathLength += hypot(frameNew.x - last.x, frameNew.y - last.y);
+			}
+			points.push_back({frameNew, currCmd == 'M' || currCmd == 'm', newCurve});
+			newCurve = false;
+			frameOld = frameNew;
+			last = frameNew;
+		});
+	});
+}
+
+// the keyframe selection outcome of a single point spacing and edge
+typedef struct tuneTrialData
+{
+	double ptSpacing;
+	int edge;
+	// the number of keyframes (excluding EOC delay frames) and end of curve markers in each SVG file
+	vector<int> frameKeyframes;
+	vector<int> frameEocs;
+	// the length of the curves drawn through the keyframes, in SVG units
+	double keptLength;
+} tuneTrial;
+
+/**
+ * runTuneTrial: repeat keyframe selection over the parsed SVG files using the trial's point spacing and edge.
+ * SPACED, EDGED: see processKeyframe().
+ * cfg: the runtime settings.
+ * frames: the points of each SVG file.
+ * trial: the trial to run.
+ */
+template<bool SPACED, bool EDGED>
+void runTuneTrial(const config &cfg, const vector<vector<svgPoint>> &frames, tuneTrial &trial)
+{
+	config trialCfg = cfg;
+	vector<kframe> kframeVec;
+	vector<int> eocVec;
+	// unused, as no keyframes are printed while processing a CS file
+	ofstream fOut;
+	kframe frameOld = {0, 0};
+	kframe frameNew;
+	double distSum;
+	bool newCurve;
+	size_t first;
+	size_t index;
+	size_t eocIndex;
+
+	trialCfg.ptSpacing = trial.ptSpacing;
+	trialCfg.edge = trial.edge;
+	// EOC delay frames are counted afterwards so that every EOC margin may share this trial
+	trialCfg.eocMargin = 0;
+	trial.keptLength = 0;
+	for(const vector<svgPoint> &points : frames)
+	{
+		// replay the state changes processSvgFile() and performCmd() make for this file
+		first = kframeVec.size();
+		newCurve = false;
+		distSum = 0;
+		for(const svgPoint &point : points)
+		{
+			frameNew = point.pos;
+			if(point.newCurve)
+			{
+				newCurve = true;
+			}
+			if(point.move)
+			{
+				distSum = 0;
+				frameOld = frameNew;
+			}
+			processKeyframe<cs, SPACED, EDGED>(trialCfg, kframeVec, eocVec, frameOld, frameNew, fOut, distSum, newCurve);
+		}
+		trial.frameKeyframes.push_back(kframeVec.size() - first);
+		trial.frameEocs.push_back(eocVec.size());
+		// sum the distance between consecutive keyframes, skipping the jump at each end of curve
+		eocIndex = 0;
+		for(index = max(first, (size_t)1); index < kframeVec.size(); ++index)
+		{
+			if(eocIndex < eocVec.size() && eocVec.at(eocIndex) == (int)index)
+			{
+				++eocIndex;
+			}
+			else
+			{
+				trial.keptLength += hypot(kframeVec.at(index).x - kframeVec.at(index - 1).x, kframeVec.at(index).y - kframeVec.at(index - 1).y);
+			}
+		}
+		// only the latest keyframe is needed to process the next file
+		if(!kframeVec.empty())
+		{
+			kframeVec.erase(kframeVec.begin(), kframeVec.end() - 1);
+		}
+		eocVec.clear();
+	}
+	// convert from oscilloscope coordinates
+	trial.keptLength *= DIVISOR;
+}
+
+// a runTuneTrial() instantiation
+typedef void (*tuneTrialFunc)(const config &, const vector<vector<svgPoint>> &, tuneTrial &);
+
+/**
+ * selectTuneTrial: select the runTuneTrial() instantiation matching the trial's point spacing and edge.
+ * trial: the trial to run.
+ * return the selected instantiation.
+ */
+tuneTrialFunc selectTuneTrial(const tuneTrial &trial)
+{
+	tuneTrialFunc retVal;
+	if(trial.ptSpacing > 0)
+	{
+		retVal = trial.edge > 0 ? runTuneTrial<true, true> : runTuneTrial<true, false>;
+	}
+	else
+	{
+		retVal = trial.edge > 0 ? runTuneTrial<false, true> : runTuneTrial<false, false>;
+	}
+	return retVal;
+}
+
+/**
+ * runTuneTrials: run every trial, spread across all available hardware threads.
+ * cfg: the runtime settings.
+ * frames: the points of each SVG file.
+ * trials: the trials to run.
+ */
+void runTuneTrials(const config &cfg, const vector<vector<svgPoint>> &frames, vector<tuneTrial> &trials)
+{
+	atomic<size_t> next(0);
+	vector<thread> workers;
+	unsigned int index;
+
+	for(index = 0; index < max(1u, thread::hardware_concurrency()); ++index)
+	{
+		workers.emplace_back([&]()
+		{
+			size_t trialIndex;
+			while((trialIndex = next++) < trials.size())
+			{
+				selectTuneTrial(trials.at(trialIndex))(cfg, frames, trials.at(trialIndex));
+			}
+		});
+	}
+	for(thread &worker : workers)
+	{
+		worker.join();
+	}
+}
+
+// the outcome of a single point spacing, edge and EOC margin
+typedef struct tuneResultData
+{
+	double ptSpacing;
+	int edge;
+	int eocMargin;
+	long keyframes;
+	int maxFrameKeyframes;
+	long eocs;
+	// the fraction of the path length within the configured edge that is retained by the keyframes
+	double fidelity;
+} tuneResult;
+
+/**
+ * meetsTarget: check whether a result meets every autotune target.
+ * Like the generator, a result must have at least two keyframes and one end of curve to be usable.
+ * cfg: the runtime settings.
+ * result: the result to check.
+ * return true if and only if the result is usable and no target is exceeded.
+ */
+bool meetsTarget(const config &cfg, const tuneResult &result)
+{
+	return result.keyframes >= 2 && result.eocs > 0
+		&& (!cfg.targetKeyframes || result.keyframes <= cfg.targetKeyframes)
+		&& (!cfg.targetDuration || (double)result.keyframes / cfg.fps <= cfg.targetDuration)
+		&& (!cfg.targetFrameKeyframes || result.maxFrameKeyframes <= cfg.targetFrameKeyframes);
+}
+
+/**
+ * collectTuneResults: combine each trial with every EOC margin in the search grid, keeping one result per trial.
+ * The EOC margin does not affect fidelity, so each trial keeps the largest EOC margin that meets the autotune
+ * targets (fewest trails), or an EOC margin of 1 if none does.
+ * cfg: the runtime settings.
+ * trials: the completed trials.
+ * pathLength: the total length of every curve within the configured edge, in SVG units.
+ * results: the vector to store the results.
+ */
+void collectTuneResults(const config &cfg, vector<tuneTrial> &trials, double pathLength, vector<tuneResult> &results)
+{
+	tuneResult result;
+	tuneResult chosen;
+	size_t index;
+	int frameKeyframes;
+
+	for(tuneTrial &trial : trials)
+	{
+		result.ptSpacing = trial.ptSpacing;
+		result.edge = trial.edge;
+		result.fidelity = pathLength > 0 ? trial.keptLength / pathLength : 1;
+		for(result.eocMargin = 1; result.eocMargin <= TUNE_EOC_MARGIN_MAX; ++result.eocMargin)
+		{
+			result.keyframes = 0;
+			result.maxFrameKeyframes = 0;
+			result.eocs = 0;
+			for(index = 0; index < trial.frameKeyframes.size(); ++index)
+			{
+				result.eocs += trial.frameEocs.at(index);
+				// each end of curve adds an "end of curve" and a "start of curve" delay frame per EOC margin
+				frameKeyframes = trial.frameKeyframes.at(index) + 2 * result.eocMargin * trial.frameEocs.at(index);
+				result.keyframes += frameKeyframes;
+				result.maxFrameKeyframes = max(result.maxFrameKeyframes, frameKeyframes);
+			}
+			// without any end of curve every EOC margin is identical, so the first is kept
+			if(result.eocMargin == 1 || (result.eocs && meetsTarget(cfg, result)))
+			{
+				chosen = result;
+			}
+		}
+		results.push_back(chosen);
+	}
+}
+
+/**
+ * isBetterResult: compare two results that both meet the autotune targets.
+ * The highest fidelity wins. Ties go to the largest EOC margin (fewest trails), then to the fewest keyframes.
+ * The EOC margin is meaningless without any end of curve, so it is only compared when both results have one.
+ * a: the first result.
+ * b: the second result.
+ * return true if and only if a is better than b.
+ */
+bool isBetterResult(const tuneResult &a, const tuneResult &b)
+{
+	bool retVal;
+	if(a.fidelity != b.fidelity)
+	{
+		retVal = a.fidelity > b.fidelity;
+	}
+	else if(a.eocs && b.eocs && a.eocMargin != b.eocMargin)
+	{
+		retVal = a.eocMargin > b.eocMargin;
+	}
+	else
+	{
+		retVal = a.keyframes < b.keyframes;
+	}
+	return retVal;
+}
+
+/**
+ * printTuneResult: print a single result as a row of the autotune table.
+ * cfg: the runtime settings.
+ * result: the result to print.
+ * isBest: true if and only if this is the best result, which is marked with an asterisk.
+ */
+void printTuneResult(const config &cfg, const tuneResult &result, bool isBest)
+{
+	cout << fixed << setprecision(2)
+		<< setw(12) << result.ptSpacing
+		<< setw(8) << result.edge
+		<< setw(12) << result.eocMargin
+		<< setw(12) << result.keyframes
+		<< setw(12) << (double)result.keyframes / cfg.fps
+		<< setw(12) << result.maxFrameKeyframes
+		<< setw(11) << result.fidelity * 100 << "%" << (isBest ? " *" : "") << endl;
+}
+
+/**
+ * printParetoFront: print every result not beaten on both keyframe count and fidelity by another result.
+ * Ties keep the order of the search grid.
+ * cfg: the runtime settings.
+ * results: the results of the search, one per point spacing and edge.
+ * best: the best result, or nullptr if there is none.
+ */
+void printParetoFront(const config &cfg, const vector<tuneResult> &results, const tuneResult *best)
+{
+	double bestFidelity = -1;
+	vector<const tuneResult *> sorted;
+
+	for(const tuneResult &result : results)
+	{
+		sorted.push_back(&result);
+	}
+	stable_sort(sorted.begin(), sorted.end(), [](const tuneResult *a, const tuneResult *b)
+	{
+		return a->keyframes != b->keyframes ? a->keyframes < b->keyframes : a->fidelity > b->fidelity;
+	});
+	cout << "Pareto front of keyframes against fidelity (* marks the best configuration):" << endl;
+	cout << setw(12) << "pt-spacing" << setw(8) << "edge" << setw(12) << "eoc-margin" << setw(12) << "keyframes"
+		<< setw(12) << "duration" << setw(12) << "max/frame" << setw(12) << "fidelity" << endl;
+	for(const tuneResult *result : sorted)
+	{
+		if(result->fidelity > bestFidelity)
+		{
+			bestFidelity = result->fidelity;
+			printTuneResult(cfg, *result, result == best);
+		}
+	}
+}
+
+/**
+ * getTunedConfigName: obtain the name of the config file autotune writes (<output name>.tuned.conf).
+ * cfg: the runtime settings.
+ * return the file name.
+ */
+string getTunedConfigName(const config &cfg)
+{
+	return cfg.outputName + ".tuned.conf";
+}
+
+/**
+ * checkTunedConfigName: make sure that autotune will not overwrite a config file that was loaded with --config.
+ * cfg: the runtime settings.
+ * return 0 if and only if no errors occur.
+ */
+int checkTunedConfigName(const config &cfg)
+{
+	int retVal = 0;
+	string fileName = getTunedConfigName(cfg);
+	// error_code overload, as equivalent() throws when the tuned config does not exist yet
+	error_code err;
+
+	for(const string &loaded : cfg.configFiles)
+	{
+		if(!retVal && filesystem::equivalent(loaded, fileName, err))
+		{
+			retVal = ERR_BAD_ARG;
+			cout << "Refusing to overwrite config file " << fileName << ", which was loaded with --config. Choose another output-name." << endl;
+		}
+	}
+	return retVal;
+}
+
+/**
+ * writeConfigFile: write the runtime settings to the tuned config file, see getTunedConfigName().
+ * cfg: the runtime settings.
+ * return 0 if and only if no errors occur.
+ */
+int writeConfigFile(const config &cfg)
+{
+	int retVal = 0;
+	ofstream fOut;
+	string extension;
+	string fileName = getTunedConfigName(cfg);
+
+	retVal = getExtension(cfg, extension);
+	if(!retVal)
+	{
+		fOut.open(fileName, ios::out);
+		if(fOut)
+		{
+			fOut << "# generated by osziApple --autotune\n"
+				"frame-start = " << cfg.frameStart << "\n"
+				"frame-end = " << cfg.frameEnd << "\n"
+				"fps = " << cfg.fps << "\n"
+				"pt-spacing = " << cfg.ptSpacing << "\n"
+				"edge = " << cfg.edge << "\n"
+				"eoc-margin = " << cfg.eocMargin << "\n"
+				"decimal-places = " << cfg.decimalPlaces << "\n"
+				"ext = " << extension << "\n"
+				"svg-path = " << cfg.svgPath << "\n"
+				"output-name = " << cfg.outputName << "\n";
+			fOut.close();
+			cout << "Wrote config file " << fileName << endl;
+		}
+		else
+		{
+			retVal = ERR_FCREATE_FAIL;
+		}
+	}
+	return retVal;
+}
+
+/**
+ * autotune: search for the point spacing, edge and EOC margin that best meet the autotune targets.
+ * The SVG files are parsed once, after which keyframe selection is repeated for every combination in the search grid.
+ * cfg: the runtime settings. The best combination is stored here and written to a config file.
+ * return 0 if and only if no errors occur.
+ */
+int autotune(config &cfg)
+{
+	int retVal = 0;
+	vector<vector<svgPoint>> frames;
+	double pathLength = 0;
+	vector<tuneTrial> trials;
+	vector<tuneResult> results;
+	const tuneResult *best = nullptr;
+	tuneTrial trial = {};
+	int spacing;
+
+	if(!cfg.targetKeyframes && !cfg.targetDuration && !cfg.targetFrameKeyframes)
+	{
+		retVal = ERR_BAD_ARG;
+		cout << "Autotune requires at least one of target-keyframes, target-duration or target-frame-keyframes." << endl;
+	}
+	if(!retVal)
+	{
+		retVal = checkTunedConfigName(cfg);
+	}
+	if(!retVal)
+	{
+		retVal = loadSvgFiles(cfg, frames, pathLength);
+	}
+	if(!retVal)
+	{
+		for(spacing = 0; spacing <= TUNE_SPACING_MAX; spacing += TUNE_SPACING_STEP)
+		{
+			// a smaller edge than configured would only add points near the edge, which fidelity ignores
+			for(trial.edge = cfg.edge; trial.edge <= max(cfg.edge, TUNE_EDGE_MAX); trial.edge += TUNE_EDGE_STEP)
+			{
+				trial.ptSpacing = spacing;
+				trials.push_back(trial);
+			}
+		}
+		runTuneTrials(cfg, frames, trials);
+		collectTuneResults(cfg, trials, pathLength, results);
+		for(tuneResult &result : results)
+		{
+			if(meetsTarget(cfg, result) && (!best || isBetterResult(result, *best)))
+			{
+				best = &result;
+			}
+		}
+		printParetoFront(cfg, results, best);
+		if(best)
+		{
+			cout << "Best configuration:" << endl;
+			printTuneResult(cfg, *best, true);
+			cfg.ptSpacing = best->ptSpacing;
+			cfg.edge = best->edge;
+			cfg.eocMargin = best->eocMargin;
+			retVal = writeConfigFile(cfg);
+		}
+		else
+		{
+			retVal = ERR_TUNE_FAIL;
+			cout << "No configuration in the search grid meets the target." << endl;
+		}
+	}
+	return retVal;
+}
+
+/**
+ * parseInt: convert an entire string to an integer.
+ * str: the string to convert.
+ * value: the integer to store the result.
+ * return true if and only if the entire string is a valid integer within the range of an int.
+ */
+bool parseInt(const string &str, int &value)
+{
+	char *end;
+	long parsed;
+	bool retVal;
+
+	errno = 0;
+	parsed = strtol(str.c_str(), &end, 10);
+	retVal = !str.empty() && *end == '\0' && errno != ERANGE && parsed >= INT_MIN && parsed <= INT_MAX;
+	if(retVal)
+	{
+		value = (int)parsed;
+	}
+	return retVal;
+}
+
+/**
+ * parseDouble: convert an entire string to a double.
+ * str: the string to convert.
+ * value: the double to store the result.
+ * return true if and only if the entire string is a valid, finite number.
+ */
+bool parseDouble(const string &str, double &value)
+{
+	char *end;
+	double parsed = strtod(str.c_str(), &end);
+	bool retVal = !str.empty() && *end == '\0' && isfinite(parsed);
+	if(retVal)
+	{
+		value = parsed;
+	}
+	return retVal;
+}
+
+/**
+ * applySetting: change a single runtime setting. 
+ * The same keys are used on the command line (--key value) and in config files (key = value).
+ * key: the name of the setting.
+ * value: the new value of the setting.
+ * cfg: the runtime settings.
+ * return 0 if and only if no errors occur.
+ */
+int applySetting(const string &key, const string &value, config &cfg)
+{
+	int retVal = 0;
+	bool valid = true;
+
+	if(key == "frame-start")
+	{
+		valid = parseInt(value, cfg.frameStart) && cfg.frameStart >= 1;
+	}
+	else if(key == "frame-end")
+	{
+		valid = parseInt(value, cfg.frameEnd);
+	}
+	else if(key == "fps")
+	{
+		valid = parseInt(value, cfg.fps) && cfg.fps > 0;
+	}
+	else if(key == "pt-spacing")
+	{
+		valid = parseDouble(value, cfg.ptSpacing) && cfg.ptSpacing >= 0;
+	}
+	else if(key == "edge")
+	{
+		valid = parseInt(value, cfg.edge) && cfg.edge >= 0;
+	}
+	else if(key == "eoc-margin")
+	{
+		valid = parseInt(value, cfg.eocMargin) && cfg.eocMargin >= 0;
+	}
+	else if(key == "decimal-places")
+	{
+		valid = parseInt(value, cfg.decimalPlaces) && cfg.decimalPlaces >= 0;
+	}
+	else if(key == "ext")
+	{
+		retVal = parseExtension(value, cfg.outExt);
+	}
+	else if(key == "svg-path")
+	{
+		cfg.svgPath = value;
+	}
+	else if(key == "output-name")
+	{
+		cfg.outputName = value;
+	}
+	else if(key == "target-keyframes")
+	{
+		valid = parseInt(value, cfg.targetKeyframes) && cfg.targetKeyframes >= 0;
+	}
+	else if(key == "target-duration")
+	{
+		valid = parseDouble(value, cfg.targetDuration) && cfg.targetDuration >= 0;
+	}
+	else if(key == "target-frame-keyframes")
+	{
+		valid = parseInt(value, cfg.targetFrameKeyframes) && cfg.targetFrameKeyframes >= 0;
+	}
+	else
+	{
+		retVal = ERR_BAD_ARG;
+		cout << "Could not recognize setting \'" << key << "\'." << endl;
+	}
+	if(!valid)
+	{
+		retVal = ERR_BAD_ARG;
+		cout << "Invalid value \'" << value << "\' for setting \'" << key << "\'." << endl;
+	}
+	return retVal;
+}
+
+/**
+ * trimString: remove leading and trailing whitespace from a string.
+ * str: the string to trim.
+ * return the trimmed string.
+ */
+string trimString(const string &str)
+{
+	size_t first = str.find_first_not_of(" \t\r");
+	size_t last = str.find_last_not_of(" \t\r");
+	return first == string::npos ? "" : str.substr(first, last - first + 1);
+}
+
+/**
+ * loadConfigFile: apply every setting found in a config file.
+ * Each line holds one "key = value" pair. Text following a '#' is ignored.
+ * fileName: the name of the config file.
+ * cfg: the runtime settings.
+ * return 0 if and only if no errors occur.
+ */
+int loadConfigFile(const string &fileName, config &cfg)
+{
+	int retVal = 0;
+	ifstream fIn(fileName, ios::in);
+	string line;
+	string key;
+	string value;
+	size_t pos;
+
+	if(!fIn)
+	{
+		retVal = ERR_CONFIG_FAIL;
+		cout << "Could not open config file " << fileName << endl;
+	}
+	else
+	{
+		cfg.configFiles.push_back(fileName);
+	}
+	while(!retVal && getline(fIn, line))
+	{
+		// strip comments
+		line = line.substr(0, line.find('#'));
+		pos = line.find('=');
+		if(pos != string::npos)
+		{
+			// the key and value are surrounded by optional whitespace
+			key = trimString(line.substr(0, pos));
+			value = trimString(line.substr(pos + 1));
+			retVal = applySetting(key, value, cfg);
+		}
+		else if(line.find_first_not_of(" \t\r") != string::npos)
+		{
+			retVal = ERR_CONFIG_FAIL;
+			cout << "Could not parse line \'" << line << "\' in config file " << fileName << endl;
+		}
+	}
+	return retVal;
+}
+
+/**
+ * parseArgs: apply the settings given on the command line, in order.
+ * Each argument takes the form "--key value", where "--config file" loads a config file.
+ * The lone argument "--autotune" enables autotune mode.
+ * argc: the number of arguments.
+ * argv: the arguments.
+ * cfg: the runtime settings.
+ * return 0 if and only if no errors occur.
+ */
+int parseArgs(int argc, char *argv[], config &cfg)
+{
+	int retVal = 0;
+	int index;
+	string key;
+
+	for(index = 1; index < argc && !retVal; ++index)
+	{
+		key = argv[index];
+		if(key == "--autotune")
+		{
+			cfg.autotune = true;
+		}
+		else if(key.compare(0, 2, "--") || index + 1 >= argc)
+		{
+			retVal = ERR_BAD_ARG;
+			cout << "Expected \"--key value\" but found \'" << key << "\'." << endl;
+		}
+		else if(key == "--config")
+		{
+			retVal = loadConfigFile(argv[++index], cfg);
+		}
+		else
+		{
+			retVal = applySetting(key.substr(2), argv[++index], cfg);
+		}
+	}
+	if(!retVal && cfg.frameEnd < cfg.frameStart)
+	{
+		retVal = ERR_BAD_ARG;
+		cout << "The frame range " << cfg.frameStart << "-" << cfg.frameEnd << " is empty." << endl;
+	}
+	return retVal;
+}
+
 /**
  * printRetMsg: print either an error or success message based on the return value.
  * retVal: the given return value.
@@ -646,6 +1537,18 @@ void printRetMsg(int retVal)
 		case ERR_UNKNOWN_SVG_CMD:
 			cout << "Error: unknown SVG command" << endl;
 			break;
+		case ERR_BAD_ARG:
+			cout << "Error: invalid command line argument or setting" << endl;
+			break;
+		case ERR_CONFIG_FAIL:
+			cout << "Error: failure to read config file" << endl;
+			break;
+		case ERR_TUNE_FAIL:
+			cout << "Error: autotune target cannot be met" << endl;
+			break;
+		case ERR_NO_KEYFRAMES:
+			cout << "Error: too few keyframes generated, try a smaller pt-spacing or edge" << endl;
+			break;
 		default:
 			cout << "Unknown error encountered" << endl;
 			break;
@@ -654,9 +1557,6 @@ void printRetMsg(int retVal)
 
 int main(int argc, char *argv[])
 {
-	(void)argc;
-	(void)argv;
-	
 	vector<kframe> kframeVec;
 	// the end of curve vector contains frame numbers that mark the end of a continuous curve before moving to the next
 	vector<int> eocVec;
@@ -665,20 +1565,36 @@ int main(int argc, char *argv[])
 	int retVal = 0;
 	// the output file extension
 	string extension;
+	// the runtime settings
+	config cfg;
 
-	retVal = getExtension(extension);
-	if(!retVal)
+	retVal = parseArgs(argc, argv, cfg);
+	if(!retVal && cfg.autotune)
+	{
+		retVal = autotune(cfg);
+	}
+	else if(!retVal)
 	{
-		fOut.open(OUTPUT_NAME "." + extension, ios::out);
+		retVal = getExtension(cfg, extension);
+	}
+	if(!retVal && !cfg.autotune)
+	{
+		fOut.open(cfg.outputName + "." + extension, ios::out);
 		if(fOut)
 		{
-			printPreamble(fOut);
+			printPreamble(cfg, fOut);
 			// traverse SVG files containing frame data
-			retVal = traverseSvgFiles(kframeVec, eocVec, fOut);
+			retVal = selectTraverse(cfg)(cfg, kframeVec, eocVec, fOut);
+			// the output requires at least two keyframes and one end of curve
+			if(!retVal && (kframeVec.size() < 2 || eocVec.empty()))
+			{
+				retVal = ERR_NO_KEYFRAMES;
+				cout << "Only " << kframeVec.size() << " keyframes and " << eocVec.size() << " ends of curve were generated." << endl;
+			}
 			if(!retVal)
 			{
 				// print postamble if all input files were successful
-				printPostamble(kframeVec, eocVec, fOut);
+				printPostamble(kframeVec, eocVec, cfg, fOut);
 			}
 			fOut.close();
 		}
@@ -687,6 +1603,10 @@ int main(int argc, char *argv[])
 			retVal = ERR_FCREATE_FAIL;
 		}
 	}
-	printRetMsg(retVal);
+	// autotune generates no output file. writeConfigFile() reports its success instead
+	if(retVal || !cfg.autotune)
+	{
+		printRetMsg(retVal);
+	}
 	return retVal;
 }